@@ -12,6 +12,12 @@ typedef struct Chai_View {
     size_t count;
 } Chai_View;
 
+typedef struct Chai_Bits {
+    unsigned long long *words;
+    size_t count;
+    size_t capacity;
+} Chai_Bits;
+
 void * chai_malloc(size_t size);
 void * chai_realloc(void *ptr, size_t size);
 void chai_free(void *ptr);
@@ -25,6 +31,11 @@ char chai_to_upper(char c);
 char chai_to_lower(char c);
 int chai_to_digit(char c);
 size_t chai_find_list_capacity(size_t count);
+int chai_word_count_ones(unsigned long long word);
+int chai_word_find_first(unsigned long long word);
+void chai_refs_increment(size_t *refs);
+size_t chai_refs_decrement(size_t *refs);
+size_t chai_refs_count(size_t *refs);
 
 void chai_mem_set(const void *mem, unsigned char value, size_t count);
 void chai_mem_copy(const void *mem, const void *source, size_t count);
@@ -51,8 +62,30 @@ bool chai_view_to_str(Chai_View view, char *buffer);
 bool chai_view_to_int(Chai_View view, int *buffer);
 bool chai_view_to_float(Chai_View view, float *buffer);
 
+Chai_Bits chai_bits_new(size_t count);
+Chai_Bits chai_bits_clone(Chai_Bits other);
+void chai_bits_free(Chai_Bits bits);
+bool chai_bits_get(Chai_Bits bits, size_t index);
+void chai_bits_set(Chai_Bits *bits, size_t index);
+void chai_bits_unset(Chai_Bits *bits, size_t index);
+void chai_bits_fill(Chai_Bits *bits, size_t a, size_t b, bool value);
+void chai_bits_append(Chai_Bits *bits, bool value);
+void chai_bits_resize(Chai_Bits *bits, size_t count);
+void chai_bits_clear(Chai_Bits *bits);
+void chai_bits_and(Chai_Bits *bits, Chai_Bits other);
+void chai_bits_or(Chai_Bits *bits, Chai_Bits other);
+void chai_bits_xor(Chai_Bits *bits, Chai_Bits other);
+void chai_bits_and_not(Chai_Bits *bits, Chai_Bits other);
+size_t chai_bits_count(Chai_Bits bits);
+int chai_bits_find_first(Chai_Bits bits);
+int chai_bits_find_next(Chai_Bits bits, size_t index);
+
 #define CHAI_SPACE " \t\v\r\n\f"
 #define CHAI_LIST_START_CAPACITY 16
+#define CHAI_WORD_SIZE 64
+#define CHAI_WORD_ONES (~0ULL)
+
+#define CHAI_FIND_WORD_COUNT(count) (((count) + CHAI_WORD_SIZE - 1) / CHAI_WORD_SIZE)
 
 #define CHAI_CAST(type) (type)
 
@@ -97,15 +130,16 @@ bool chai_view_to_float(Chai_View view, float *buffer);
                                                                                                         \
     List_Type prefix ## _clone(List_Type other) {                                                       \
         List_Type result;                                                                               \
-        if (other.capacity == 0) {                                                                      \
+        if (other.count == 0) {                                                                         \
             result.items = NULL;                                                                        \
             result.count = 0;                                                                           \
             result.capacity = 0;                                                                        \
         } else {                                                                                        \
-            result.items = chai_malloc(other.capacity * sizeof(Item_Type));                             \
-            chai_mem_copy(result.items, other.items, other.capacity * sizeof(Item_Type));               \
+            size_t capacity = chai_find_list_capacity(other.count);                                     \
+            result.items = chai_malloc(capacity * sizeof(Item_Type));                                   \
+            chai_mem_copy(result.items, other.items, other.count * sizeof(Item_Type));                  \
             result.count = other.count;                                                                 \
-            result.capacity = other.capacity;                                                           \
+            result.capacity = capacity;                                                                 \
         }                                                                                               \
         return result;                                                                                  \
     }                                                                                                   \
@@ -207,6 +241,371 @@ bool chai_view_to_float(Chai_View view, float *buffer);
         prefix ## _resize(list, 0);                                                                     \
     }
 
+/// Creates a new list type whose clones share the same items until one of them changes.
+/// Cloning only increments a reference count and the first change of a shared list copies its items.
+/// The items should only be changed directly after calling the own procedure.
+/// Define CHAI_ATOMIC_REFS to clone and free the lists from different threads.
+/// The first argument is the type of the list item.
+/// The second argument is the name of the list.
+/// The third argument is the prefix that each procedure associated with the list will use.
+#define CHAI_CREATE_SHARED_LIST_TYPE(Item_Type, List_Type, prefix)                                      \
+    typedef struct List_Type {                                                                          \
+        Item_Type *items;                                                                               \
+        size_t count;                                                                                   \
+        size_t capacity;                                                                                \
+        size_t *refs;                                                                                   \
+    } List_Type;                                                                                        \
+                                                                                                        \
+    List_Type prefix ## _new(size_t count) {                                                            \
+        List_Type result;                                                                               \
+        if (count == 0) {                                                                               \
+            result.items = NULL;                                                                        \
+            result.count = 0;                                                                           \
+            result.capacity = 0;                                                                        \
+            result.refs = NULL;                                                                         \
+        } else {                                                                                        \
+            size_t capacity = chai_find_list_capacity(count);                                           \
+            result.items = chai_malloc(capacity * sizeof(Item_Type));                                   \
+            chai_mem_set(result.items, 0, capacity * sizeof(Item_Type));                                \
+            result.count = count;                                                                       \
+            result.capacity = capacity;                                                                 \
+            result.refs = chai_malloc(sizeof(size_t));                                                  \
+            *result.refs = 1;                                                                           \
+        }                                                                                               \
+        return result;                                                                                  \
+    }                                                                                                   \
+                                                                                                        \
+    List_Type prefix ## _clone(List_Type other) {                                                       \
+        if (other.refs != NULL) {                                                                       \
+            chai_refs_increment(other.refs);                                                            \
+        }                                                                                               \
+        return other;                                                                                   \
+    }                                                                                                   \
+                                                                                                        \
+    void prefix ## _free(List_Type list) {                                                              \
+        if (list.refs != NULL && chai_refs_decrement(list.refs) == 0) {                                 \
+            chai_free(list.items);                                                                      \
+            chai_free(list.refs);                                                                       \
+        }                                                                                               \
+    }                                                                                                   \
+                                                                                                        \
+    void prefix ## _own(List_Type *list) {                                                              \
+        if (list->refs == NULL) {                                                                       \
+            list->refs = chai_malloc(sizeof(size_t));                                                   \
+            *list->refs = 1;                                                                            \
+        } else if (chai_refs_count(list->refs) > 1) {                                                   \
+            List_Type result;                                                                           \
+            result.count = list->count;                                                                 \
+            result.capacity = chai_find_list_capacity(list->count);                                     \
+            result.items = chai_malloc(result.capacity * sizeof(Item_Type));                            \
+            chai_mem_copy(result.items, list->items, list->count * sizeof(Item_Type));                  \
+            result.refs = chai_malloc(sizeof(size_t));                                                  \
+            *result.refs = 1;                                                                           \
+            prefix ## _free(*list);                                                                     \
+            *list = result;                                                                             \
+        }                                                                                               \
+    }                                                                                                   \
+                                                                                                        \
+    const Item_Type * prefix ## _item(List_Type list, size_t index) {                                   \
+        if (index >= list.count) {                                                                      \
+            return NULL;                                                                                \
+        }                                                                                               \
+        return list.items + index;                                                                      \
+    }                                                                                                   \
+                                                                                                        \
+    void prefix ## _fill(List_Type *list, Item_Type item) {                                             \
+        prefix ## _own(list);                                                                           \
+        for (size_t i = 0; i < list->count; i += 1) {                                                   \
+            list->items[i] = item;                                                                      \
+        }                                                                                               \
+    }                                                                                                   \
+                                                                                                        \
+    void prefix ## _append(List_Type *list, Item_Type item) {                                           \
+        prefix ## _own(list);                                                                           \
+        list->count += 1;                                                                               \
+        if (list->count > list->capacity) {                                                             \
+            size_t capacity = chai_find_list_capacity(list->count);                                     \
+            list->items = chai_realloc(list->items, capacity * sizeof(Item_Type));                      \
+            list->capacity = capacity;                                                                  \
+        }                                                                                               \
+        list->items[list->count - 1] = item;                                                            \
+    }                                                                                                   \
+                                                                                                        \
+    void prefix ## _insert(List_Type *list, size_t index, Item_Type item) {                             \
+        if (index > list->count) {                                                                      \
+            return;                                                                                     \
+        }                                                                                               \
+        prefix ## _own(list);                                                                           \
+        list->count += 1;                                                                               \
+        if (list->count > list->capacity) {                                                             \
+            size_t capacity = chai_find_list_capacity(list->count);                                     \
+            list->items = chai_realloc(list->items, capacity * sizeof(Item_Type));                      \
+            list->capacity = capacity;                                                                  \
+        }                                                                                               \
+        for (size_t i = list->count - 1; i > index; i -= 1) {                                           \
+            list->items[i] = list->items[i - 1];                                                        \
+        }                                                                                               \
+        list->items[index] = item;                                                                      \
+    }                                                                                                   \
+                                                                                                        \
+    void prefix ## _remove(List_Type *list, size_t index) {                                             \
+        if (index >= list->count) {                                                                     \
+            return;                                                                                     \
+        }                                                                                               \
+        prefix ## _own(list);                                                                           \
+        for (size_t i = index; i < list->count - 1; i += 1) {                                           \
+            list->items[i] = list->items[i + 1];                                                        \
+        }                                                                                               \
+        list->count -= 1;                                                                               \
+    }                                                                                                   \
+                                                                                                        \
+    void prefix ## _remove_swap(List_Type *list, size_t index) {                                        \
+        if (index >= list->count) {                                                                     \
+            return;                                                                                     \
+        }                                                                                               \
+        prefix ## _own(list);                                                                           \
+        list->items[index] = list->items[list->count - 1];                                              \
+        list->count -= 1;                                                                               \
+    }                                                                                                   \
+                                                                                                        \
+    void prefix ## _resize(List_Type *list, size_t count) {                                             \
+        prefix ## _own(list);                                                                           \
+        size_t old_count = list->count;                                                                 \
+        list->count = count;                                                                            \
+        if (list->count > list->capacity) {                                                             \
+            size_t capacity = chai_find_list_capacity(list->count);                                     \
+            list->items = chai_realloc(list->items, capacity * sizeof(Item_Type));                      \
+            list->capacity = capacity;                                                                  \
+        }                                                                                               \
+        if (list->count > old_count) {                                                                  \
+            chai_mem_set(list->items + old_count, 0, (list->count - old_count) * sizeof(Item_Type));    \
+        }                                                                                               \
+    }                                                                                                   \
+                                                                                                        \
+    void prefix ## _reserve(List_Type *list, size_t additional) {                                       \
+        prefix ## _own(list);                                                                           \
+        size_t count = list->count + additional;                                                        \
+        if (count > list->capacity) {                                                                   \
+            size_t capacity = chai_find_list_capacity(count);                                           \
+            list->items = chai_realloc(list->items, capacity * sizeof(Item_Type));                      \
+            list->capacity = capacity;                                                                  \
+        }                                                                                               \
+    }                                                                                                   \
+                                                                                                        \
+    void prefix ## _shrink(List_Type *list) {                                                           \
+        prefix ## _own(list);                                                                           \
+        size_t capacity = chai_find_list_capacity(list->count);                                         \
+        if (capacity != list->capacity) {                                                               \
+            list->items = chai_realloc(list->items, capacity * sizeof(Item_Type));                      \
+            list->capacity = capacity;                                                                  \
+        }                                                                                               \
+    }                                                                                                   \
+                                                                                                        \
+    void prefix ## _clear(List_Type *list) {                                                            \
+        if (list->refs != NULL && chai_refs_count(list->refs) > 1) {                                    \
+            prefix ## _free(*list);                                                                     \
+            *list = prefix ## _new(0);                                                                  \
+        } else {                                                                                        \
+            list->count = 0;                                                                            \
+        }                                                                                               \
+    }
+
+/// Creates a new list type that stores its items inline and never allocates.
+/// Procedures that add items return false instead of growing when the list is full.
+/// The first argument is the type of the list item.
+/// The second argument is the name of the list.
+/// The third argument is the prefix that each procedure associated with the list will use.
+/// The fourth argument is the maximum number of items the list can hold.
+#define CHAI_CREATE_FIXED_LIST_TYPE(Item_Type, List_Type, prefix, item_capacity)                        \
+    typedef struct List_Type {                                                                          \
+        Item_Type items[item_capacity];                                                                 \
+        size_t count;                                                                                   \
+    } List_Type;                                                                                        \
+                                                                                                        \
+    List_Type prefix ## _new(size_t count) {                                                            \
+        List_Type result = {0};                                                                         \
+        result.count = count > (item_capacity) ? (item_capacity) : count;                               \
+        return result;                                                                                  \
+    }                                                                                                   \
+                                                                                                        \
+    Item_Type * prefix ## _item(List_Type *list, size_t index) {                                        \
+        if (index >= list->count) {                                                                     \
+            return NULL;                                                                                \
+        }                                                                                               \
+        return list->items + index;                                                                     \
+    }                                                                                                   \
+                                                                                                        \
+    void prefix ## _fill(List_Type *list, Item_Type item) {                                             \
+        for (size_t i = 0; i < list->count; i += 1) {                                                   \
+            list->items[i] = item;                                                                      \
+        }                                                                                               \
+    }                                                                                                   \
+                                                                                                        \
+    bool prefix ## _append(List_Type *list, Item_Type item) {                                           \
+        if (list->count >= (item_capacity)) {                                                           \
+            return false;                                                                               \
+        }                                                                                               \
+        list->items[list->count] = item;                                                                \
+        list->count += 1;                                                                               \
+        return true;                                                                                    \
+    }                                                                                                   \
+                                                                                                        \
+    bool prefix ## _insert(List_Type *list, size_t index, Item_Type item) {                             \
+        if (index > list->count || list->count >= (item_capacity)) {                                    \
+            return false;                                                                               \
+        }                                                                                               \
+        list->count += 1;                                                                               \
+        for (size_t i = list->count - 1; i > index; i -= 1) {                                           \
+            list->items[i] = list->items[i - 1];                                                        \
+        }                                                                                               \
+        list->items[index] = item;                                                                      \
+        return true;                                                                                    \
+    }                                                                                                   \
+                                                                                                        \
+    void prefix ## _remove(List_Type *list, size_t index) {                                             \
+        if (index >= list->count) {                                                                     \
+            return;                                                                                     \
+        }                                                                                               \
+        for (size_t i = index; i < list->count - 1; i += 1) {                                           \
+            list->items[i] = list->items[i + 1];                                                        \
+        }                                                                                               \
+        list->count -= 1;                                                                               \
+    }                                                                                                   \
+                                                                                                        \
+    void prefix ## _remove_swap(List_Type *list, size_t index) {                                        \
+        if (index >= list->count) {                                                                     \
+            return;                                                                                     \
+        }                                                                                               \
+        list->items[index] = list->items[list->count - 1];                                              \
+        list->count -= 1;                                                                               \
+    }                                                                                                   \
+                                                                                                        \
+    bool prefix ## _resize(List_Type *list, size_t count) {                                             \
+        if (count > (item_capacity)) {                                                                  \
+            return false;                                                                               \
+        }                                                                                               \
+        if (count > list->count) {                                                                      \
+            chai_mem_set(list->items + list->count, 0, (count - list->count) * sizeof(Item_Type));      \
+        }                                                                                               \
+        list->count = count;                                                                            \
+        return true;                                                                                    \
+    }                                                                                                   \
+                                                                                                        \
+    void prefix ## _clear(List_Type *list) {                                                            \
+        list->count = 0;                                                                                \
+    }
+
+/// Creates a new heap type that keeps the item that should be first at index zero.
+/// The heap is a list, so every list procedure is also created for it.
+/// Appending items and calling heapify once is faster than pushing them one by one.
+/// The first argument is the type of the heap item.
+/// The second argument is the name of the heap.
+/// The third argument is the prefix that each procedure associated with the heap will use.
+/// The fourth argument is a macro that takes two items and returns true if the first item should be before the second.
+/// The fifth argument is the number of children each node has. A value of 4 works better for large heaps.
+#define CHAI_CREATE_HEAP_TYPE(Item_Type, Heap_Type, prefix, is_before, arity)                           \
+    CHAI_CREATE_LIST_TYPE(Item_Type, Heap_Type, prefix)                                                 \
+                                                                                                        \
+    void prefix ## _sift_up(Heap_Type *heap, size_t index) {                                            \
+        if (index >= heap->count) {                                                                     \
+            return;                                                                                     \
+        }                                                                                               \
+        Item_Type item = heap->items[index];                                                            \
+        while (index > 0) {                                                                             \
+            size_t parent = (index - 1) / (arity);                                                      \
+            if (!is_before(item, heap->items[parent])) {                                                \
+                break;                                                                                  \
+            }                                                                                           \
+            heap->items[index] = heap->items[parent];                                                   \
+            index = parent;                                                                             \
+        }                                                                                               \
+        heap->items[index] = item;                                                                      \
+    }                                                                                                   \
+                                                                                                        \
+    void prefix ## _sift_down(Heap_Type *heap, size_t index) {                                          \
+        if (index >= heap->count) {                                                                     \
+            return;                                                                                     \
+        }                                                                                               \
+        Item_Type item = heap->items[index];                                                            \
+        while (true) {                                                                                  \
+            size_t first = index * (arity) + 1;                                                         \
+            if (first >= heap->count) {                                                                 \
+                break;                                                                                  \
+            }                                                                                           \
+            size_t last = first + (arity);                                                              \
+            if (last > heap->count) {                                                                   \
+                last = heap->count;                                                                     \
+            }                                                                                           \
+            size_t child = first;                                                                       \
+            for (size_t i = first + 1; i < last; i += 1) {                                              \
+                if (is_before(heap->items[i], heap->items[child])) {                                    \
+                    child = i;                                                                          \
+                }                                                                                       \
+            }                                                                                           \
+            if (!is_before(heap->items[child], item)) {                                                 \
+                break;                                                                                  \
+            }                                                                                           \
+            heap->items[index] = heap->items[child];                                                    \
+            index = child;                                                                              \
+        }                                                                                               \
+        heap->items[index] = item;                                                                      \
+    }                                                                                                   \
+                                                                                                        \
+    void prefix ## _heapify(Heap_Type *heap) {                                                          \
+        if (heap->count < 2) {                                                                          \
+            return;                                                                                     \
+        }                                                                                               \
+        for (size_t i = (heap->count - 2) / (arity) + 1; i > 0; i -= 1) {                               \
+            prefix ## _sift_down(heap, i - 1);                                                          \
+        }                                                                                               \
+    }                                                                                                   \
+                                                                                                        \
+    Item_Type * prefix ## _peek(Heap_Type heap) {                                                       \
+        return prefix ## _item(heap, 0);                                                                \
+    }                                                                                                   \
+                                                                                                        \
+    void prefix ## _push(Heap_Type *heap, Item_Type item) {                                             \
+        prefix ## _append(heap, item);                                                                  \
+        prefix ## _sift_up(heap, heap->count - 1);                                                      \
+    }                                                                                                   \
+                                                                                                        \
+    bool prefix ## _pop(Heap_Type *heap, Item_Type *buffer) {                                           \
+        if (heap->count == 0) {                                                                         \
+            return false;                                                                               \
+        }                                                                                               \
+        if (buffer != NULL) {                                                                           \
+            *buffer = heap->items[0];                                                                   \
+        }                                                                                               \
+        heap->items[0] = heap->items[heap->count - 1];                                                  \
+        heap->count -= 1;                                                                               \
+        prefix ## _sift_down(heap, 0);                                                                  \
+        return true;                                                                                    \
+    }                                                                                                   \
+                                                                                                        \
+    void prefix ## _replace_top(Heap_Type *heap, Item_Type item) {                                      \
+        if (heap->count == 0) {                                                                         \
+            prefix ## _push(heap, item);                                                                \
+            return;                                                                                     \
+        }                                                                                               \
+        heap->items[0] = item;                                                                          \
+        prefix ## _sift_down(heap, 0);                                                                  \
+    }                                                                                                   \
+                                                                                                        \
+    bool prefix ## _push_bounded(Heap_Type *heap, size_t limit, Item_Type item) {                       \
+        if (limit == 0) {                                                                               \
+            return false;                                                                               \
+        }                                                                                               \
+        if (heap->count < limit) {                                                                      \
+            prefix ## _push(heap, item);                                                                \
+            return true;                                                                                \
+        }                                                                                               \
+        if (!is_before(heap->items[0], item)) {                                                         \
+            return false;                                                                               \
+        }                                                                                               \
+        prefix ## _replace_top(heap, item);                                                             \
+        return true;                                                                                    \
+    }
+
 #endif // CHAI_HEADER
 
 #ifdef CHAI_IMPLEMENTATION
@@ -284,6 +683,60 @@ size_t chai_find_list_capacity(size_t count) {
     return result;
 }
 
+int chai_word_count_ones(unsigned long long word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(word);
+#else
+    int result = 0;
+    while (word != 0) {
+        word &= word - 1;
+        result += 1;
+    }
+    return result;
+#endif
+}
+
+int chai_word_find_first(unsigned long long word) {
+    if (word == 0) {
+        return -1;
+    }
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(word);
+#else
+    int result = 0;
+    while ((word & 1) == 0) {
+        word >>= 1;
+        result += 1;
+    }
+    return result;
+#endif
+}
+
+void chai_refs_increment(size_t *refs) {
+#ifdef CHAI_ATOMIC_REFS
+    __atomic_fetch_add(refs, 1, __ATOMIC_RELAXED);
+#else
+    *refs += 1;
+#endif
+}
+
+size_t chai_refs_decrement(size_t *refs) {
+#ifdef CHAI_ATOMIC_REFS
+    return __atomic_sub_fetch(refs, 1, __ATOMIC_ACQ_REL);
+#else
+    *refs -= 1;
+    return *refs;
+#endif
+}
+
+size_t chai_refs_count(size_t *refs) {
+#ifdef CHAI_ATOMIC_REFS
+    return __atomic_load_n(refs, __ATOMIC_ACQUIRE);
+#else
+    return *refs;
+#endif
+}
+
 void chai_mem_set(const void *mem, unsigned char value, size_t count) {
     for (size_t i = 0; i < count; i += 1) {
         (CHAI_CAST(unsigned char *) mem)[i] = value;
@@ -576,5 +1029,201 @@ bool chai_view_to_float(Chai_View view, float *buffer) {
     return true;
 }
 
+Chai_Bits chai_bits_new(size_t count) {
+    Chai_Bits result;
+    if (count == 0) {
+        result.words = NULL;
+        result.count = 0;
+        result.capacity = 0;
+    } else {
+        size_t capacity = chai_find_list_capacity(CHAI_FIND_WORD_COUNT(count));
+        result.words = chai_malloc(capacity * sizeof(unsigned long long));
+        chai_mem_set(result.words, 0, capacity * sizeof(unsigned long long));
+        result.count = count;
+        result.capacity = capacity;
+    }
+    return result;
+}
+
+Chai_Bits chai_bits_clone(Chai_Bits other) {
+    Chai_Bits result;
+    if (other.count == 0) {
+        result.words = NULL;
+        result.count = 0;
+        result.capacity = 0;
+    } else {
+        size_t word_count = CHAI_FIND_WORD_COUNT(other.count);
+        size_t capacity = chai_find_list_capacity(word_count);
+        result.words = chai_malloc(capacity * sizeof(unsigned long long));
+        chai_mem_copy(result.words, other.words, word_count * sizeof(unsigned long long));
+        chai_mem_set(result.words + word_count, 0, (capacity - word_count) * sizeof(unsigned long long));
+        result.count = other.count;
+        result.capacity = capacity;
+    }
+    return result;
+}
+
+void chai_bits_free(Chai_Bits bits) {
+    chai_free(bits.words);
+}
+
+bool chai_bits_get(Chai_Bits bits, size_t index) {
+    if (index >= bits.count) {
+        return false;
+    }
+    return (bits.words[index / CHAI_WORD_SIZE] >> (index % CHAI_WORD_SIZE)) & 1;
+}
+
+void chai_bits_set(Chai_Bits *bits, size_t index) {
+    if (index >= bits->count) {
+        return;
+    }
+    bits->words[index / CHAI_WORD_SIZE] |= 1ULL << (index % CHAI_WORD_SIZE);
+}
+
+void chai_bits_unset(Chai_Bits *bits, size_t index) {
+    if (index >= bits->count) {
+        return;
+    }
+    bits->words[index / CHAI_WORD_SIZE] &= ~(1ULL << (index % CHAI_WORD_SIZE));
+}
+
+void chai_bits_fill(Chai_Bits *bits, size_t a, size_t b, bool value) {
+    if (a >= b || b > bits->count) {
+        return;
+    }
+    size_t first = a / CHAI_WORD_SIZE;
+    size_t last = (b - 1) / CHAI_WORD_SIZE;
+    unsigned long long first_mask = CHAI_WORD_ONES << (a % CHAI_WORD_SIZE);
+    unsigned long long last_mask = CHAI_WORD_ONES >> (CHAI_WORD_SIZE - 1 - (b - 1) % CHAI_WORD_SIZE);
+    if (first == last) {
+        first_mask &= last_mask;
+    }
+    if (value) {
+        bits->words[first] |= first_mask;
+        for (size_t i = first + 1; i < last; i += 1) {
+            bits->words[i] = CHAI_WORD_ONES;
+        }
+        if (first != last) {
+            bits->words[last] |= last_mask;
+        }
+    } else {
+        bits->words[first] &= ~first_mask;
+        for (size_t i = first + 1; i < last; i += 1) {
+            bits->words[i] = 0;
+        }
+        if (first != last) {
+            bits->words[last] &= ~last_mask;
+        }
+    }
+}
+
+void chai_bits_append(Chai_Bits *bits, bool value) {
+    chai_bits_resize(bits, bits->count + 1);
+    if (value) {
+        chai_bits_set(bits, bits->count - 1);
+    }
+}
+
+void chai_bits_resize(Chai_Bits *bits, size_t count) {
+    // The bits after the count are always zero, so growing does not need to clear anything.
+    if (count < bits->count) {
+        chai_bits_fill(bits, count, bits->count, false);
+    }
+    bits->count = count;
+    size_t word_count = CHAI_FIND_WORD_COUNT(count);
+    if (word_count > bits->capacity) {
+        size_t capacity = chai_find_list_capacity(word_count);
+        bits->words = chai_realloc(bits->words, capacity * sizeof(unsigned long long));
+        chai_mem_set(bits->words + bits->capacity, 0, (capacity - bits->capacity) * sizeof(unsigned long long));
+        bits->capacity = capacity;
+    }
+}
+
+void chai_bits_clear(Chai_Bits *bits) {
+    chai_bits_resize(bits, 0);
+}
+
+void chai_bits_and(Chai_Bits *bits, Chai_Bits other) {
+    size_t word_count = CHAI_FIND_WORD_COUNT(bits->count);
+    size_t other_word_count = CHAI_FIND_WORD_COUNT(other.count);
+    for (size_t i = 0; i < word_count; i += 1) {
+        if (i < other_word_count) {
+            bits->words[i] &= other.words[i];
+        } else {
+            bits->words[i] = 0;
+        }
+    }
+}
+
+void chai_bits_or(Chai_Bits *bits, Chai_Bits other) {
+    size_t word_count = CHAI_FIND_WORD_COUNT(bits->count);
+    size_t other_word_count = CHAI_FIND_WORD_COUNT(other.count);
+    for (size_t i = 0; i < word_count && i < other_word_count; i += 1) {
+        bits->words[i] |= other.words[i];
+    }
+    if (other.count > bits->count && bits->count % CHAI_WORD_SIZE != 0) {
+        bits->words[word_count - 1] &= CHAI_WORD_ONES >> (CHAI_WORD_SIZE - bits->count % CHAI_WORD_SIZE);
+    }
+}
+
+void chai_bits_xor(Chai_Bits *bits, Chai_Bits other) {
+    size_t word_count = CHAI_FIND_WORD_COUNT(bits->count);
+    size_t other_word_count = CHAI_FIND_WORD_COUNT(other.count);
+    for (size_t i = 0; i < word_count && i < other_word_count; i += 1) {
+        bits->words[i] ^= other.words[i];
+    }
+    if (other.count > bits->count && bits->count % CHAI_WORD_SIZE != 0) {
+        bits->words[word_count - 1] &= CHAI_WORD_ONES >> (CHAI_WORD_SIZE - bits->count % CHAI_WORD_SIZE);
+    }
+}
+
+void chai_bits_and_not(Chai_Bits *bits, Chai_Bits other) {
+    size_t word_count = CHAI_FIND_WORD_COUNT(bits->count);
+    size_t other_word_count = CHAI_FIND_WORD_COUNT(other.count);
+    for (size_t i = 0; i < word_count && i < other_word_count; i += 1) {
+        bits->words[i] &= ~other.words[i];
+    }
+}
+
+size_t chai_bits_count(Chai_Bits bits) {
+    size_t result = 0;
+    size_t word_count = CHAI_FIND_WORD_COUNT(bits.count);
+    for (size_t i = 0; i < word_count; i += 1) {
+        result += chai_word_count_ones(bits.words[i]);
+    }
+    return result;
+}
+
+int chai_bits_find_first(Chai_Bits bits) {
+    size_t word_count = CHAI_FIND_WORD_COUNT(bits.count);
+    for (size_t i = 0; i < word_count; i += 1) {
+        if (bits.words[i] != 0) {
+            return CHAI_CAST(int) (i * CHAI_WORD_SIZE + chai_word_find_first(bits.words[i]));
+        }
+    }
+    return -1;
+}
+
+int chai_bits_find_next(Chai_Bits bits, size_t index) {
+    if (index + 1 >= bits.count) {
+        return -1;
+    }
+    size_t word_count = CHAI_FIND_WORD_COUNT(bits.count);
+    size_t i = (index + 1) / CHAI_WORD_SIZE;
+    unsigned long long word = bits.words[i] & (CHAI_WORD_ONES << ((index + 1) % CHAI_WORD_SIZE));
+    while (true) {
+        if (word != 0) {
+            return CHAI_CAST(int) (i * CHAI_WORD_SIZE + chai_word_find_first(word));
+        }
+        i += 1;
+        if (i >= word_count) {
+            return -1;
+        }
+        word = bits.words[i];
+    }
+    return -1;
+}
+
 #endif // CHAI_IMPLEMENTATION_ADDED
 #endif // CHAI_IMPLEMENTATION
@@ -10,7 +10,14 @@
 #define TEST(body) assert(body)
 #define TODO(msg) assert(msg && 0)
 
+#define IS_LESS(a, b) ((a) < (b))
+#define IS_GREATER(a, b) ((a) > (b))
+
 CHAI_CREATE_LIST_TYPE(int, Numbers, numbers)
+CHAI_CREATE_SHARED_LIST_TYPE(int, Shared_Numbers, shared_numbers)
+CHAI_CREATE_FIXED_LIST_TYPE(int, Fixed_Numbers, fixed_numbers, 4)
+CHAI_CREATE_HEAP_TYPE(int, Min_Heap, min_heap, IS_LESS, 2)
+CHAI_CREATE_HEAP_TYPE(int, Max_Heap, max_heap, IS_GREATER, 4)
 
 void test_utils() {
     TEST(chai_is_upper(' ') == false);
@@ -154,6 +161,191 @@ void test_view() {
     TEST(buffer_float == -69.420f);
 }
 
+void test_bits() {
+    Chai_Bits bits = chai_bits_new(200);
+    TEST(bits.count == 200);
+    TEST(chai_bits_count(bits) == 0);
+    TEST(chai_bits_find_first(bits) == -1);
+
+    chai_bits_set(&bits, 3);
+    chai_bits_set(&bits, 64);
+    chai_bits_set(&bits, 199);
+    chai_bits_set(&bits, 200);
+    TEST(chai_bits_get(bits, 3) == true);
+    TEST(chai_bits_get(bits, 4) == false);
+    TEST(chai_bits_get(bits, 200) == false);
+    TEST(chai_bits_count(bits) == 3);
+    TEST(chai_bits_find_first(bits) == 3);
+    TEST(chai_bits_find_next(bits, 3) == 64);
+    TEST(chai_bits_find_next(bits, 64) == 199);
+    TEST(chai_bits_find_next(bits, 199) == -1);
+
+    chai_bits_unset(&bits, 64);
+    TEST(chai_bits_get(bits, 64) == false);
+    TEST(chai_bits_count(bits) == 2);
+
+    chai_bits_fill(&bits, 10, 150, true);
+    TEST(chai_bits_count(bits) == 142);
+    TEST(chai_bits_get(bits, 9) == false);
+    TEST(chai_bits_get(bits, 10) == true);
+    TEST(chai_bits_get(bits, 149) == true);
+    TEST(chai_bits_get(bits, 150) == false);
+    chai_bits_fill(&bits, 20, 30, false);
+    TEST(chai_bits_count(bits) == 132);
+
+    Chai_Bits other = chai_bits_clone(bits);
+    TEST(chai_bits_count(other) == chai_bits_count(bits));
+    chai_bits_xor(&other, bits);
+    TEST(chai_bits_count(other) == 0);
+    chai_bits_fill(&other, 0, 100, true);
+    chai_bits_and(&other, bits);
+    TEST(chai_bits_count(other) == 81);
+    chai_bits_or(&other, bits);
+    TEST(chai_bits_count(other) == chai_bits_count(bits));
+    chai_bits_and_not(&other, bits);
+    TEST(chai_bits_count(other) == 0);
+
+    chai_bits_resize(&bits, 15);
+    TEST(chai_bits_count(bits) == 6);
+    chai_bits_resize(&bits, 300);
+    TEST(chai_bits_count(bits) == 6);
+    chai_bits_append(&bits, true);
+    TEST(bits.count == 301);
+    TEST(chai_bits_get(bits, 300) == true);
+
+    int count = 0;
+    for (int i = chai_bits_find_first(bits); i != -1; i = chai_bits_find_next(bits, i)) {
+        count += 1;
+    }
+    TEST(count == 7);
+
+    chai_bits_clear(&bits);
+    TEST(bits.count == 0);
+    chai_bits_free(bits);
+    chai_bits_free(other);
+}
+
+void test_shared_list() {
+    Shared_Numbers list = shared_numbers_new(0);
+    for (int i = 0; i < 20; i += 1) {
+        shared_numbers_append(&list, i);
+    }
+    TEST(*list.refs == 1);
+
+    Shared_Numbers copy = shared_numbers_clone(list);
+    TEST(copy.items == list.items);
+    TEST(*list.refs == 2);
+
+    shared_numbers_append(&copy, 20);
+    TEST(copy.items != list.items);
+    TEST(*list.refs == 1);
+    TEST(*copy.refs == 1);
+    TEST(list.count == 20);
+    TEST(copy.count == 21);
+    TEST(*shared_numbers_item(copy, 19) == 19);
+    TEST(*shared_numbers_item(copy, 20) == 20);
+
+    Shared_Numbers other = shared_numbers_clone(list);
+    shared_numbers_fill(&list, 7);
+    TEST(*shared_numbers_item(list, 0) == 7);
+    TEST(*shared_numbers_item(other, 0) == 0);
+    shared_numbers_remove(&other, 0);
+    TEST(*shared_numbers_item(other, 0) == 1);
+    shared_numbers_clear(&other);
+    TEST(other.count == 0);
+
+    shared_numbers_free(list);
+    shared_numbers_free(copy);
+    shared_numbers_free(other);
+
+    Numbers numbers = numbers_new(20);
+    Numbers numbers_copy = numbers_clone(numbers);
+    TEST(numbers_copy.count == 20);
+    TEST(numbers_copy.capacity == chai_find_list_capacity(20));
+    numbers_free(numbers);
+    numbers_free(numbers_copy);
+}
+
+void test_fixed_list() {
+    Fixed_Numbers list = fixed_numbers_new(0);
+    TEST(list.count == 0);
+    TEST(fixed_numbers_item(&list, 0) == NULL);
+
+    TEST(fixed_numbers_append(&list, 1) == true);
+    TEST(fixed_numbers_append(&list, 3) == true);
+    TEST(fixed_numbers_insert(&list, 1, 2) == true);
+    TEST(fixed_numbers_insert(&list, 4, 2) == false);
+    TEST(fixed_numbers_insert(&list, 0, 0) == true);
+    TEST(list.count == 4);
+    TEST(fixed_numbers_append(&list, 4) == false);
+    TEST(fixed_numbers_insert(&list, 0, 4) == false);
+    for (int i = 0; i < 4; i += 1) {
+        TEST(*fixed_numbers_item(&list, i) == i);
+    }
+
+    fixed_numbers_remove(&list, 0);
+    TEST(list.count == 3);
+    TEST(*fixed_numbers_item(&list, 0) == 1);
+    fixed_numbers_remove_swap(&list, 0);
+    TEST(list.count == 2);
+    TEST(*fixed_numbers_item(&list, 0) == 3);
+
+    fixed_numbers_fill(&list, 7);
+    TEST(*fixed_numbers_item(&list, 1) == 7);
+    TEST(fixed_numbers_resize(&list, 5) == false);
+    TEST(fixed_numbers_resize(&list, 4) == true);
+    TEST(*fixed_numbers_item(&list, 3) == 0);
+    fixed_numbers_clear(&list);
+    TEST(list.count == 0);
+
+    list = fixed_numbers_new(10);
+    TEST(list.count == 4);
+}
+
+void test_heap() {
+    int buffer;
+
+    Min_Heap min = min_heap_new(0);
+    TEST(min_heap_peek(min) == NULL);
+    TEST(min_heap_pop(&min, &buffer) == false);
+    for (int i = 0; i < 100; i += 1) {
+        min_heap_push(&min, (i * 37) % 100);
+    }
+    TEST(*min_heap_peek(min) == 0);
+    for (int i = 0; i < 100; i += 1) {
+        TEST(min_heap_pop(&min, &buffer) == true);
+        TEST(buffer == i);
+    }
+    TEST(min.count == 0);
+
+    for (int i = 0; i < 100; i += 1) {
+        min_heap_push_bounded(&min, 5, (i * 37) % 100);
+    }
+    TEST(min.count == 5);
+    TEST(min_heap_push_bounded(&min, 5, 10) == false);
+    for (int i = 95; i < 100; i += 1) {
+        TEST(min_heap_pop(&min, &buffer) == true);
+        TEST(buffer == i);
+    }
+    min_heap_free(min);
+
+    Max_Heap max = max_heap_new(0);
+    for (int i = 0; i < 100; i += 1) {
+        max_heap_append(&max, (i * 37) % 100);
+    }
+    max_heap_heapify(&max);
+    TEST(*max_heap_peek(max) == 99);
+    max_heap_replace_top(&max, -1);
+    TEST(*max_heap_peek(max) == 98);
+    for (int i = 98; i >= 0; i -= 1) {
+        TEST(max_heap_pop(&max, &buffer) == true);
+        TEST(buffer == i);
+    }
+    TEST(max_heap_pop(&max, &buffer) == true);
+    TEST(buffer == -1);
+    max_heap_free(max);
+}
+
 void test_list() {
     TODO("Write list test.");
 }
@@ -162,6 +354,10 @@ int main() {
     test_utils();
     test_mem();
     test_view();
+    test_bits();
+    test_shared_list();
+    test_fixed_list();
+    test_heap();
     test_list();
     printf("OK!\n");
     return 0;